@@ -7,20 +7,45 @@ CHLattice::CHLattice(int xRange, int yRange, double m, double a, double k, doubl
 																			m_a(a),
 																			m_k(k),
 																			m_dx(dx),
-																			m_data(xRange*yRange,0.0)
+																			m_data(xRange*yRange)
 {
+	// Zero the storage row by row in parallel so each page is first touched by the thread that updates it.
+	#pragma omp parallel for schedule(static)
+	for(int j = 0; j < m_yRange; ++j)
+	{
+		std::fill_n(m_data.begin() + j * m_xRange, m_xRange, 0.0);
+	}
 
+}
 
+CHLattice::CHLattice(const CHLattice &other) : m_xRange(other.m_xRange),
+											   m_yRange(other.m_yRange),
+											   m_dx(other.m_dx),
+											   m_M(other.m_M),
+											   m_a(other.m_a),
+											   m_k(other.m_k),
+											   m_data(other.m_data.size())
+{
+	#pragma omp parallel for schedule(static)
+	for(int j = 0; j < m_yRange; ++j)
+	{
+		std::copy_n(other.m_data.begin() + j * m_xRange, m_xRange, m_data.begin() + j * m_xRange);
+	}
 
 }
 
-void CHLattice::initialise(double initialValue, double noise, std::default_random_engine &generator)
+void CHLattice::initialise(double initialValue, double noise, std::uint64_t seed)
 {
-	static std::uniform_real_distribution<double> distribution(-noise,noise);
+	Philox generator(seed);
 
-	for(auto &phi : m_data)
+	#pragma omp parallel for schedule(static)
+	for(int j = 0; j < m_yRange; ++j)
 	{
-		phi = initialValue + distribution(generator);
+		for(int i = 0; i < m_xRange; ++i)
+		{
+			std::uint64_t site = static_cast<std::uint64_t>(i) + static_cast<std::uint64_t>(j) * m_xRange;
+			m_data[site] = initialValue + noise * (2.0 * generator.uniform(site) - 1.0);
+		}
 	}
 }
 
@@ -83,9 +108,11 @@ double CHLattice::nextValue(int i, int j, double dt) const
 
 void update(CHLattice &currentLattice, CHLattice &updateLattice, double dt)
 {
-	for(int i = 0; i < currentLattice.m_xRange; ++i)
+	// Rows are shared between threads with the same static schedule used to first touch them.
+	#pragma omp parallel for schedule(static)
+	for(int j = 0; j < currentLattice.m_yRange; ++j)
 	{
-		for(int j = 0; j < currentLattice.m_yRange; ++j)
+		for(int i = 0; i < currentLattice.m_xRange; ++i)
 		{
 			updateLattice(i,j) = currentLattice.nextValue(i, j, dt);
 		}
@@ -4,9 +4,11 @@
 #include <vector> // For holding the values of the function.
 #include <algorithm>
 #include <iostream>
-#include <random>
+#include <cstdint>
 #include <cmath>
 #include <iomanip>
+#include "Philox.hpp" // For counter-based random noise.
+#include "FirstTouchAllocator.hpp" // For NUMA-local first-touch storage.
 
 /**
  *\file
@@ -16,6 +18,9 @@
  * 2D lattice consisiting of an array of floating points which represent the values of the order parameter
  * at some time t. The lattice can be evolved through time according to the Euler algorithm to give the 
  * evolution of the order parameter.
+ *
+ * The lattice storage is first touched in parallel, row by row, with the same static schedule as 
+ * the update sweep, so each thread's rows live on its own NUMA node.
  */
  class CHLattice
  {
@@ -40,7 +45,7 @@
     double m_k;
 
     /// Vector to hold the values of the order parameter at each lattice site.
-    std::vector<double> m_data;
+    std::vector<double, FirstTouchAllocator<double>> m_data;
 
  public:
     /**
@@ -55,13 +60,27 @@
      */
     CHLattice(int xRange, int yRange, double m, double a, double k, double dx);
 
+    /**
+     *\brief Copies a lattice, touching the new storage in parallel so it stays NUMA-local.
+     *\param other lattice to be copied.
+     */
+    CHLattice(const CHLattice &other);
+
+    CHLattice(CHLattice &&other) = default;
+    CHLattice& operator=(const CHLattice &other) = default;
+    CHLattice& operator=(CHLattice &&other) = default;
+
     /**
      *\brief Initializes lattice with some value at each site plus some noise
+     *
+     * The noise at each site is drawn from a counter-based generator keyed on the seed and the site 
+     * index, so the initial state is the same whatever the number of threads.
+     *
      *\param initialValue initial value at each lattice site.
-     *\param maximum magnitude of initial noise which will be uniformly distributed. 
-     *\param *\param generator reference to random engine to generate random noise.
+     *\param noise maximum magnitude of initial noise which will be uniformly distributed. 
+     *\param seed integer value used to key the random noise.
      */
-    void initialise(double initialValue, double noise, std::default_random_engine &generator);
+    void initialise(double initialValue, double noise, std::uint64_t seed);
 
     /**
      *\brief Calculates the chemical potential for a given point in the lattice.
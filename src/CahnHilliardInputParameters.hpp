@@ -2,6 +2,7 @@
 #define CahnHilliardInputParameters_hpp
 #include <iostream>
 #include <iomanip>
+#include <cstdint>
 /**
  *\file 
  *\class CahnHilliardInputParameters
@@ -35,6 +36,9 @@ public:
     /// Maximum magnitude of initial noise.
     double noise;
 
+    /// Seed used for the initial noise.
+    std::uint64_t seed;
+
     /// Number of steps to evolve equation for.
     int totalSteps;
 
@@ -0,0 +1,99 @@
+#ifndef FirstTouchAllocator_hpp
+#define FirstTouchAllocator_hpp
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <utility>
+#ifdef CH_HUGE_PAGES
+#include <sys/mman.h> // For madvise.
+#endif
+
+/**
+ *\file
+ *\class FirstTouchAllocator
+ *\brief Allocator which leaves the memory it hands out untouched.
+ *
+ * Linux places a page of memory on the NUMA node of the thread that first writes to it. A std::vector
+ * with the standard allocator value-initialises every element on the constructing thread, so the whole
+ * lattice ends up on a single node. This allocator default-initialises instead (a no-op for doubles) 
+ * so the pages are first touched by whichever threads later fill them in parallel.
+ *
+ * If CH_HUGE_PAGES is defined the storage is aligned to 2MB and the kernel is advised to back it with 
+ * transparent huge pages.
+ */
+template<typename T>
+class FirstTouchAllocator
+{
+public:
+	using value_type = T;
+
+	/// Alignment used for allocations when huge pages are requested.
+	static const std::size_t hugePageSize = 2 * 1024 * 1024;
+
+	FirstTouchAllocator() = default;
+
+	template<typename U>
+	FirstTouchAllocator(const FirstTouchAllocator<U>&) {}
+
+	template<typename U>
+	struct rebind { using other = FirstTouchAllocator<U>; };
+
+	/**
+	 *\brief Allocates uninitialised storage for n objects.
+	 *\param n number of objects to allocate space for.
+	 *\return pointer to the start of the storage.
+	 */
+	T* allocate(std::size_t n)
+	{
+		std::size_t bytes = n * sizeof(T);
+		void *p = nullptr;
+#ifdef CH_HUGE_PAGES
+		if(bytes >= hugePageSize)
+		{
+			if(posix_memalign(&p, hugePageSize, bytes) != 0)
+			{
+				throw std::bad_alloc();
+			}
+			madvise(p, bytes, MADV_HUGEPAGE);
+			return static_cast<T*>(p);
+		}
+#endif
+		p = std::malloc(bytes);
+		if(!p && bytes)
+		{
+			throw std::bad_alloc();
+		}
+		return static_cast<T*>(p);
+	}
+
+	/**
+	 *\brief Releases storage obtained from allocate.
+	 *\param p pointer to the storage.
+	 */
+	void deallocate(T *p, std::size_t)
+	{
+		std::free(p);
+	}
+
+	/// Default-initialises rather than value-initialises so no memory is written.
+	template<typename U>
+	void construct(U *p)
+	{
+		::new(static_cast<void*>(p)) U;
+	}
+
+	template<typename U, typename... Args>
+	void construct(U *p, Args&&... args)
+	{
+		::new(static_cast<void*>(p)) U(std::forward<Args>(args)...);
+	}
+};
+
+template<typename T, typename U>
+bool operator==(const FirstTouchAllocator<T>&, const FirstTouchAllocator<U>&) { return true; }
+
+template<typename T, typename U>
+bool operator!=(const FirstTouchAllocator<T>&, const FirstTouchAllocator<U>&) { return false; }
+
+#endif /* FirstTouchAllocator_hpp */
@@ -0,0 +1,54 @@
+#include "Philox.hpp"
+
+namespace
+{
+	// Multipliers and Weyl key increments from Salmon et al. "Parallel random numbers: as easy as 1, 2, 3".
+	const std::uint32_t multiplier0 = 0xD2511F53;
+	const std::uint32_t multiplier1 = 0xCD9E8D57;
+	const std::uint32_t weyl0 = 0x9E3779B9;
+	const std::uint32_t weyl1 = 0xBB67AE85;
+	const int rounds = 10;
+}
+
+Philox::Philox(std::uint64_t seed) : m_key{{static_cast<std::uint32_t>(seed),
+											static_cast<std::uint32_t>(seed >> 32)}}
+{
+
+}
+
+Philox::block_t Philox::operator()(std::uint64_t counter, std::uint64_t stream) const
+{
+	block_t ctr{{static_cast<std::uint32_t>(counter),
+				 static_cast<std::uint32_t>(counter >> 32),
+				 static_cast<std::uint32_t>(stream),
+				 static_cast<std::uint32_t>(stream >> 32)}};
+
+	std::uint32_t k0 = m_key[0];
+	std::uint32_t k1 = m_key[1];
+
+	for(int round = 0; round < rounds; ++round)
+	{
+		std::uint64_t product0 = static_cast<std::uint64_t>(multiplier0) * ctr[0];
+		std::uint64_t product1 = static_cast<std::uint64_t>(multiplier1) * ctr[2];
+
+		ctr = {{static_cast<std::uint32_t>(product1 >> 32) ^ ctr[1] ^ k0,
+				static_cast<std::uint32_t>(product1),
+				static_cast<std::uint32_t>(product0 >> 32) ^ ctr[3] ^ k1,
+				static_cast<std::uint32_t>(product0)}};
+
+		k0 += weyl0;
+		k1 += weyl1;
+	}
+
+	return ctr;
+}
+
+double Philox::uniform(std::uint64_t counter) const
+{
+	block_t block = (*this)(counter);
+
+	// Combine 53 bits from two of the words to fill the mantissa of a double.
+	std::uint64_t bits = (static_cast<std::uint64_t>(block[0]) << 21) ^ (block[1] >> 11);
+
+	return bits * (1.0 / 9007199254740992.0);
+}
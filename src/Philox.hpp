@@ -0,0 +1,50 @@
+#ifndef Philox_hpp
+#define Philox_hpp
+
+#include <array>
+#include <cstdint>
+
+/**
+ *\file
+ *\class Philox
+ *\brief Counter-based pseudo random number generator (Philox4x32-10).
+ *
+ * Unlike a conventional engine this generator has no internal state that advances between calls, 
+ * each output is a pure function of a 64-bit key and a 128-bit counter. This means any lattice site
+ * can draw its random numbers directly from its own index, so the lattice can be filled in any order
+ * or by any number of threads and still give exactly the same result.
+ */
+class Philox
+{
+public:
+	/// Type of a block of four random 32-bit words produced by one call.
+	using block_t = std::array<std::uint32_t, 4>;
+
+private:
+	/// Two 32-bit words of the key, taken from the seed.
+	std::array<std::uint32_t, 2> m_key;
+
+public:
+	/**
+	 *\brief Creates a generator keyed on a seed.
+	 *\param seed 64-bit integer value used as the key of the generator.
+	 */
+	explicit Philox(std::uint64_t seed);
+
+	/**
+	 *\brief Produces the block of random words associated with a counter.
+	 *\param counter 64-bit counter e.g. the index of the lattice site.
+	 *\param stream 64-bit value to select independent streams for the same counter.
+	 *\return four uniformly distributed 32-bit words.
+	 */
+	block_t operator()(std::uint64_t counter, std::uint64_t stream = 0) const;
+
+	/**
+	 *\brief Produces a uniformly distributed double in [0,1) associated with a counter.
+	 *\param counter 64-bit counter e.g. the index of the lattice site.
+	 *\return floating point value in the range [0,1) using 53 random bits.
+	 */
+	double uniform(std::uint64_t counter) const;
+};
+
+#endif /* Philox_hpp */
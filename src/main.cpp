@@ -4,7 +4,7 @@
 #include <fstream> // For file output.
 #include <chrono> // For timing.
 #include <ctime>  // For timing.
-#include <random> // For generating random numbers.
+#include <cstdint> // For the random seed.
 #include <cmath> // For any maths functions.  
 #include <iomanip> // For manipulating output.
 #include <string> // For naming output directory.
@@ -24,11 +24,8 @@ int main(int argc, char const *argv[])
     // Start the clock so execution time can be calculated. 
     Timer timer;
 
-    // Seed the pseudo random number generator using the system clock.
-    unsigned int seed = static_cast<unsigned int>(std::chrono::system_clock::now().time_since_epoch().count());
-
-    // Create a generator that can be fed to any distribution to produce pseudo random numbers according to that distribution. 
-    std::default_random_engine generator(seed);
+    // Seed the counter-based generator used for the initial noise using the system clock unless the user gives one.
+    std::uint64_t seed = static_cast<std::uint64_t>(std::chrono::system_clock::now().time_since_epoch().count());
 
 /*************************************************************************************************************************
 ******************************************************** Input **********************************************************
@@ -82,6 +79,7 @@ int main(int argc, char const *argv[])
         ("steps,n", boost::program_options::value<int>(&totalSteps)->default_value(100000),"Total number of steps to evolve differential equation for.")
         ("x-range,r", boost::program_options::value<int>(&xRange)->default_value(100),"Total number of x points in domain of simulation domain.")
         ("y-range,c", boost::program_options::value<int>(&yRange)->default_value(100),"Total number of y points in domain of simulation domain.")
+        ("seed,s", boost::program_options::value<std::uint64_t>(&seed), "Seed for the initial noise, defaults to the system clock.")
         ("output,o",boost::program_options::value<std::string>(&outputName)->default_value(getTimeStamp()), "Name of output directory to save output files into.")
         ("animate,a","Output the lattice after each update for animation.")
         ("help,h","Display help message.");
@@ -108,6 +106,7 @@ int main(int argc, char const *argv[])
         kConstant,
         initialValue,
         noise,
+        seed,
         totalSteps, 
         xRange,
         yRange,
@@ -144,7 +143,7 @@ int main(int argc, char const *argv[])
     // Create the lattice to be used in the simulation, we need two one to hold the current state and one to be updated
     // we can then swap them for performance.
     CHLattice currentLattice(xRange,yRange, mConstant, aConstant, kConstant, spaceStep);
-    currentLattice.initialise(initialValue, noise, generator);
+    currentLattice.initialise(initialValue, noise, seed);
     CHLattice updatedLattice = currentLattice;
 
     // Print the initial lattice at t = 0.